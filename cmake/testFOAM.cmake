@@ -392,6 +392,40 @@ IF(BUILD_TESTING)
         endif()
     ENDIF(RUN_FROM_ONE_TIMESTEP)
 
+    # Add the FOAM unit tests located under applications/test
+    #
+    # They are built by the unitTests target above.  Every test compares a
+    # threaded or optimised code path against the sequential or legacy one
+    # and returns nonzero on any difference
+    ADD_TEST(
+        collatedRestart
+        ${FOAM_ROOT}/applications/test/collatedRestart/Allrun
+    )
+    ADD_TEST(
+        particleArrays
+        ${FOAM_ROOT}/applications/test/particleArrays/Allrun
+    )
+    ADD_TEST(
+        hexRef8Threads
+        ${FOAM_ROOT}/applications/test/hexRef8Threads/Allrun
+    )
+    ADD_TEST(
+        parallelAddressing
+        ${FOAM_ROOT}/applications/test/parallelAddressing/Allrun
+    )
+    ADD_TEST(
+        numberParsing
+        $ENV{FOAM_USER_APPBIN}/numberParsingTest
+    )
+    ADD_TEST(
+        fieldCodec
+        $ENV{FOAM_USER_APPBIN}/fieldCodecTest
+    )
+    ADD_TEST(
+        interfaceGaussSeidel
+        ${FOAM_ROOT}/applications/test/interfaceGaussSeidel/Allrun
+    )
+
 ENDIF(BUILD_TESTING)
 
 # That's it.